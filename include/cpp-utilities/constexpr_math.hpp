@@ -0,0 +1,599 @@
+// Copyright 2023 Alexandre Coderre-Chabot
+//
+// This file is licensed under the MIT license. For more information, visit:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//   substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//   BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// This file was originally obtained from:
+//     https://github.com/acodcha/cpp-utilities
+
+#ifndef CPP_UTILITIES_CONSTEXPR_MATH_HPP
+#define CPP_UTILITIES_CONSTEXPR_MATH_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "constexpr_sqrt.hpp"
+
+// Constant expression math functions. The accuracy bounds and the handling of NaN, infinite, and
+// subnormal numbers documented below are guaranteed when these functions are evaluated at compile
+// time, which always uses strict IEEE 754 floating-point arithmetic. At run time, they hold only if
+// the calling code is compiled with strict IEEE 754 floating-point arithmetic. Options such as
+// -ffast-math, which this project's own build uses, void them: accuracy degrades by hundreds of
+// ULP or more, NaN and infinite arguments may yield meaningless results, and subnormal numbers may
+// be flushed to zero. Even so, no argument ever causes an out-of-bounds access, under any options.
+
+// Namespace that encompasses all of the C++ Utilities library's content.
+namespace utility {
+
+// Namespace that contains internal implementation details of the C++ Utilities library. Content
+// within this namespace is not meant to be used except by the the C++ Utilities library's own
+// functions and classes.
+namespace internal {
+
+// Returns a table of every power of 2 that is representable as a double-precision floating-point
+// number, from 2^-1074 at index 0 to 2^1023 at index 2097. Every entry is exact. This function is
+// an internal implementation detail and is not intended to be used except by the C++ Utilities
+// library's constant expression math functions.
+[[nodiscard]] inline constexpr std::array<double, 2098> make_constexpr_powers_of_two() {
+  std::array<double, 2098> powers{};
+  powers[1074] = 1.0;
+  for (std::size_t index = 1075; index < powers.size(); ++index) {
+    powers[index] = 2.0 * powers[index - 1];
+  }
+  for (std::size_t index = 1074; index > 0; --index) {
+    powers[index - 1] = 0.5 * powers[index];
+  }
+  return powers;
+}
+
+// Table of every power of 2 that is representable as a double-precision floating-point number. The
+// table is computed once at compile time so that the constant expression math functions can scale
+// numbers and extract their exponents with a few lookups rather than with repeated squaring, which
+// keeps compile-time evaluation within the compiler's constant expression evaluation limits.
+inline constexpr std::array<double, 2098> constexpr_powers_of_two = make_constexpr_powers_of_two();
+
+// Returns 2 raised to the power of the given exponent. The result is exact if the exponent is
+// within the [-1074, 1023] interval. Otherwise, the result underflows to zero or overflows to
+// infinity. This function is an internal implementation detail and is not intended to be used
+// except by the C++ Utilities library's constant expression math functions.
+[[nodiscard]] inline constexpr double constexpr_power_of_two(const int exponent) {
+  // Check the bounds of the table such that no exponent can index outside of it.
+  if (exponent < -1074) {
+    return 0.0;
+  }
+  if (exponent > 1023) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return constexpr_powers_of_two[static_cast<std::size_t>(exponent + 1074)];
+}
+
+// Returns a number multiplied by 2 raised to the power of the given exponent. This is equivalent to
+// std::ldexp, except that it is a constant expression. The result is rounded at most once, when it
+// falls within the subnormal range. The result must not overflow, since an overflow is not a
+// constant expression. This function is an internal implementation detail and is not intended to be
+// used except by the C++ Utilities library's constant expression math functions.
+[[nodiscard]] inline constexpr double constexpr_scale(double number, int exponent) {
+  // Scaling any finite non-zero number by more than 2^2200 or less than 2^-2200 always overflows or
+  // underflows, so clamping the exponent to this interval does not change the result, and it keeps
+  // the arithmetic on the exponent below from overflowing.
+  exponent = exponent < -2200 ? -2200 : (exponent > 2200 ? 2200 : exponent);
+
+  // Scaling up is exact until the result overflows, so it can be split into several steps.
+  if (exponent > 1023) {
+    number *= constexpr_power_of_two(1023);
+    exponent -= 1023;
+    if (exponent > 1023) {
+      number *= constexpr_power_of_two(1023);
+      exponent -= 1023;
+    }
+    return number * constexpr_power_of_two(exponent);
+  }
+
+  // Scaling down rounds once the result becomes subnormal, so the steps that keep the number normal
+  // come first and the single step that can round comes last. Scaling by 2^-969 cannot take a
+  // number from above 2^-52 to below 2^-1022, and a result that needs the steps before it to round
+  // as well is far below the subnormal range, where it underflows to zero anyway.
+  if (exponent < -1022) {
+    exponent += 969;
+    if (exponent < -1022) {
+      number *= constexpr_power_of_two(-1022);
+      exponent += 1022;
+    }
+    number *= constexpr_power_of_two(exponent);
+    return number * constexpr_power_of_two(-969);
+  }
+
+  return number * constexpr_power_of_two(exponent);
+}
+
+// Returns the binary exponent of a positive finite number, which is the integer E such that the
+// number divided by 2^E falls within the [1, 2[ interval. This is similar to std::ilogb, except
+// that it is a constant expression. This function is an internal implementation detail and is not
+// intended to be used except by the C++ Utilities library's constant expression math functions.
+[[nodiscard]] inline constexpr int constexpr_exponent(const double number) {
+  // Binary search the table of powers of 2 for the greatest power of 2 that does not exceed the
+  // number. This takes at most 12 comparisons.
+  std::size_t lower = 0;
+  std::size_t upper = constexpr_powers_of_two.size() - 1;
+  while (lower < upper) {
+    const std::size_t middle = (lower + upper + 1) / 2;
+    if (constexpr_powers_of_two[middle] <= number) {
+      lower = middle;
+    } else {
+      upper = middle - 1;
+    }
+  }
+  return static_cast<int>(lower) - 1074;
+}
+
+// Double-double number, which is the unevaluated sum of two double-precision floating-point
+// numbers whose magnitudes do not overlap. It carries about 106 bits of precision, which the
+// constant expression math functions use internally so that their final results are accurate to
+// within one unit in the last place. This struct is an internal implementation detail and is not
+// intended to be used except by the C++ Utilities library's constant expression math functions.
+struct constexpr_double_double {
+  // Leading component. This is the double-precision floating-point number nearest to the value.
+  double high = 0.0;
+
+  // Trailing component. This is the rounding error of the leading component.
+  double low = 0.0;
+};
+
+// Returns the exact sum of two numbers as a double-double number, assuming that the magnitude of
+// the first number is greater than or equal to that of the second number.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_quick_two_sum(
+    const double first, const double second) {
+  const double sum = first + second;
+  return {sum, second - (sum - first)};
+}
+
+// Returns the exact sum of two numbers as a double-double number.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_two_sum(
+    const double first, const double second) {
+  const double sum = first + second;
+  const double second_virtual = sum - first;
+  return {sum, (first - (sum - second_virtual)) + (second - second_virtual)};
+}
+
+// Returns the exact product of two numbers as a double-double number. The numbers must be smaller
+// than 2^996 in magnitude so that splitting them does not overflow.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_two_product(
+    const double first, const double second) {
+  // Split each number into two halves of 26 bits each such that the products of the halves are
+  // exact. The splitting factor is 2^27 + 1.
+  const double first_scaled = 134217729.0 * first;
+  const double first_high = first_scaled - (first_scaled - first);
+  const double first_low = first - first_high;
+  const double second_scaled = 134217729.0 * second;
+  const double second_high = second_scaled - (second_scaled - second);
+  const double second_low = second - second_high;
+  const double product = first * second;
+  return {product, ((first_high * second_high - product) + first_high * second_low
+                    + first_low * second_high)
+                       + first_low * second_low};
+}
+
+// Returns the sum of two double-double numbers.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_add(
+    const constexpr_double_double& first, const constexpr_double_double& second) {
+  const constexpr_double_double sum = constexpr_two_sum(first.high, second.high);
+  return constexpr_quick_two_sum(sum.high, sum.low + first.low + second.low);
+}
+
+// Returns the product of two double-double numbers.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_multiply(
+    const constexpr_double_double& first, const constexpr_double_double& second) {
+  const constexpr_double_double product = constexpr_two_product(first.high, second.high);
+  return constexpr_quick_two_sum(
+      product.high, product.low + first.high * second.low + first.low * second.high);
+}
+
+// Returns the quotient of two double-double numbers. The divisor must not be zero.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_divide(
+    const constexpr_double_double& dividend, const constexpr_double_double& divisor) {
+  // Compute a first quotient, then correct it using the exact remainder.
+  const double quotient = dividend.high / divisor.high;
+  const constexpr_double_double remainder =
+      constexpr_add(dividend, constexpr_multiply(divisor, {-quotient, 0.0}));
+  return constexpr_quick_two_sum(quotient, remainder.high / divisor.high);
+}
+
+// Natural logarithm of 2 as a double-double number.
+inline constexpr constexpr_double_double constexpr_ln2{
+    6.931471805599452862e-01, 2.319046813846299558e-17};
+
+// Exponential function of a double-double number. The result is returned as a double-precision
+// floating-point number and is accurate to within one unit in the last place (1 ULP). Handles
+// overflow and underflow, but not NaN or infinite arguments.
+[[nodiscard]] inline constexpr double constexpr_exp_solver(const constexpr_double_double& number) {
+  // Arguments beyond these thresholds overflow to infinity or underflow to zero. The thresholds are
+  // deliberately loose; the exact cutoffs are handled below.
+  if (number.high > 710.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (number.high < -746.0) {
+    return 0.0;
+  }
+
+  // Reduce the argument as x = k * ln(2) + r, where k is an integer and |r| <= ln(2) / 2, such that
+  // exp(x) = 2^k * exp(r).
+  // The quotient is clamped, first as a double-precision floating-point number and then as an
+  // integer, such that even a NaN argument that reaches this point when the calling code is
+  // compiled with fast math cannot produce an out-of-range exponent. Otherwise, |k| is at most
+  // 1077, so the clamping has no effect.
+  double rounded = number.high * 1.4426950408889634;
+  rounded = rounded < -1100.0 ? -1100.0 : (rounded > 1100.0 ? 1100.0 : rounded);
+  int k = static_cast<int>(rounded >= 0.0 ? rounded + 0.5 : rounded - 0.5);
+  k = k < -1100 ? -1100 : (k > 1100 ? 1100 : k);
+  const constexpr_double_double remainder = constexpr_add(
+      number, constexpr_multiply(constexpr_ln2, {-static_cast<double>(k), 0.0}));
+
+  // Further reduce the argument as r = 256 * t, such that exp(r) = exp(t)^256 and |t| < 0.00136.
+  // Scaling by a power of 2 is exact.
+  const constexpr_double_double reduced{remainder.high * 0.00390625, remainder.low * 0.00390625};
+
+  // Compute exp(t) - 1 = t + t^2 / 2! + t^3 / 3! + ... from its Taylor series. The first two
+  // terms are computed in double-double precision. The remaining terms are less than 2^-21
+  // relative to the sum, so computing them in double precision is enough. The series is truncated
+  // after the t^7 term, at which point the truncation error is below 2^-80.
+  const double t = reduced.high;
+  const double tail =
+      t * t * t
+      * (1.0 / 6.0 + t * (1.0 / 24.0 + t * (1.0 / 120.0 + t * (1.0 / 720.0 + t / 5040.0))));
+  const constexpr_double_double square = constexpr_multiply(reduced, reduced);
+  constexpr_double_double sum =
+      constexpr_add(reduced, constexpr_add({0.5 * square.high, 0.5 * square.low}, {tail, 0.0}));
+
+  // Square eight times to obtain exp(r) - 1. Working with exp(t) - 1 rather than exp(t) preserves
+  // precision, since (1 + p)^2 - 1 = p * (2 + p).
+  for (int iteration = 0; iteration < 8; ++iteration) {
+    sum = constexpr_multiply(sum, constexpr_add({2.0, 0.0}, sum));
+  }
+  sum = constexpr_add({1.0, 0.0}, sum);
+
+  // Re-apply the factor of 2^k. The leading component of the sum lies within the [0.7, 1.5]
+  // interval, so the result overflows if and only if k exceeds 1023 and the sum is at least 1.
+  if (k > 1024 || (k == 1024 && sum.high >= 1.0)) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return constexpr_scale(sum.high, k);
+}
+
+// Natural logarithm of a positive finite number. The result is returned as a double-double number
+// and is accurate to about 75 bits. Does not handle zero, negative, NaN, or infinite arguments.
+[[nodiscard]] inline constexpr constexpr_double_double constexpr_log_solver(const double number) {
+  // Factor the number as x = m * 2^e, where m is within the [sqrt(2) / 2, sqrt(2)] interval, such
+  // that ln(x) = e * ln(2) + ln(m).
+  int exponent = constexpr_exponent(number);
+  double mantissa = constexpr_scale(number, -exponent);
+  if (mantissa > 1.4142135623730951) {
+    mantissa *= 0.5;
+    ++exponent;
+  }
+
+  // Compute ln(m) = 2 * atanh(s) = 2 * (s + s^3 / 3 + s^5 / 5 + ...), where s = (m - 1) / (m + 1).
+  // Since |s| <= 0.1716 and s^2 <= 0.0295, the series converges quickly. Note that m - 1 is exact.
+  // The first three terms are computed in double-double precision. The remaining terms are less
+  // than 2^-17 relative to the sum, so computing them in double precision is enough. The series is
+  // truncated after the s^27 term, at which point the truncation error is below 2^-75.
+  const constexpr_double_double s =
+      constexpr_divide({mantissa - 1.0, 0.0}, constexpr_two_sum(mantissa, 1.0));
+  const constexpr_double_double s_squared = constexpr_multiply(s, s);
+  const constexpr_double_double s_cubed = constexpr_multiply(s, s_squared);
+  const constexpr_double_double s_fifth = constexpr_multiply(s_cubed, s_squared);
+  const double z = s_squared.high;
+  double tail = 0.0;
+  for (int index = 27; index >= 7; index -= 2) {
+    tail = tail * z + 1.0 / static_cast<double>(index);
+  }
+  tail *= s_fifth.high * z;
+  const constexpr_double_double sum = constexpr_add(
+      s, constexpr_add(constexpr_divide(s_cubed, {3.0, 0.0}),
+                       constexpr_add(constexpr_divide(s_fifth, {5.0, 0.0}), {tail, 0.0})));
+
+  return constexpr_add(constexpr_multiply(constexpr_ln2, {static_cast<double>(exponent), 0.0}),
+                       constexpr_add(sum, sum));
+}
+
+// Returns whether a finite number is an integer.
+[[nodiscard]] inline constexpr bool constexpr_is_integer(const double number) {
+  // Every double-precision floating-point number whose magnitude is at least 2^53 is an integer.
+  if (number >= 9007199254740992.0 || number <= -9007199254740992.0) {
+    return true;
+  }
+  return static_cast<double>(static_cast<long long>(number)) == number;
+}
+
+// Returns whether a finite number is an odd integer.
+[[nodiscard]] inline constexpr bool constexpr_is_odd_integer(const double number) {
+  // Every double-precision floating-point number whose magnitude is at least 2^53 is even.
+  if (number >= 9007199254740992.0 || number <= -9007199254740992.0) {
+    return false;
+  }
+  return constexpr_is_integer(number) && static_cast<long long>(number) % 2 != 0;
+}
+
+}  // namespace internal
+
+// Returns the cube root of a double-precision floating-point number. This function is a constant
+// expression, unlike std::cbrt. When evaluated at compile time, returns a result within one unit
+// in the last place (1 ULP) of the correctly rounded cube root. Unlike the other functions in this
+// file, this bound is relative to the exact result rather than to the C++ Standard Library, since
+// some implementations of std::cbrt, such as that of glibc, are themselves off by more than 1 ULP.
+// The cube root of a NaN is NaN, and the cube roots of zero and infinity are themselves, with the
+// same sign.
+[[nodiscard]] inline constexpr double constexpr_cbrt(const double number) {
+  // The cube roots of zero and infinity are themselves, and the cube root of NaN is NaN.
+  if (number == 0.0 || std::isnan(number) || number == std::numeric_limits<double>::infinity()
+      || number == -std::numeric_limits<double>::infinity()) {
+    return number;
+  }
+
+  // The cube root of a negative number is the negative of the cube root of its magnitude.
+  if (number < 0.0) {
+    return -constexpr_cbrt(-number);
+  }
+
+  // Factor the number as x = m * 2^(3 * q), where m is within the [1, 8[ interval, such that
+  // cbrt(x) = cbrt(m) * 2^q.
+  const int exponent = internal::constexpr_exponent(number);
+  const int quotient = exponent >= 0 ? exponent / 3 : -((-exponent + 2) / 3);
+  const double mantissa = internal::constexpr_scale(number, -3 * quotient);
+
+  // Use an iterative Newton-Raphson method starting from a linear approximation of the cube root
+  // over the [1, 8[ interval. Its relative error is at most 11%, and the error is roughly squared
+  // at each iteration, so six iterations are enough to reach double precision.
+  double root = 1.0 + (mantissa - 1.0) / 7.0;
+  for (int iteration = 0; iteration < 6; ++iteration) {
+    root -= (root - mantissa / (root * root)) / 3.0;
+  }
+
+  // Apply a final Newton-Raphson correction whose residual m - root^3 is computed exactly.
+  const internal::constexpr_double_double cube = internal::constexpr_multiply(
+      internal::constexpr_two_product(root, root), {root, 0.0});
+  const internal::constexpr_double_double residual =
+      internal::constexpr_add({mantissa, 0.0}, {-cube.high, -cube.low});
+  root += residual.high / (3.0 * root * root);
+
+  return internal::constexpr_scale(root, quotient);
+}
+
+// Returns the square root of the sum of the squares of two double-precision floating-point numbers,
+// sqrt(x^2 + y^2), without intermediate overflow or underflow. This function is a constant
+// expression, unlike std::hypot. When evaluated at compile time, returns the same result as
+// std::hypot to within one unit in the last place (1 ULP). If either number is infinite, the result
+// is positive infinity, even if the other number is NaN. Otherwise, if either number is NaN, the
+// result is NaN.
+[[nodiscard]] inline constexpr double constexpr_hypot(const double first, const double second) {
+  if (first == std::numeric_limits<double>::infinity()
+      || first == -std::numeric_limits<double>::infinity()
+      || second == std::numeric_limits<double>::infinity()
+      || second == -std::numeric_limits<double>::infinity()) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  if (std::isnan(first) || std::isnan(second)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const double first_magnitude = first >= 0.0 ? first : -first;
+  const double second_magnitude = second >= 0.0 ? second : -second;
+  const double larger = first_magnitude >= second_magnitude ? first_magnitude : second_magnitude;
+  const double smaller = first_magnitude >= second_magnitude ? second_magnitude : first_magnitude;
+
+  if (smaller == 0.0) {
+    return larger;
+  }
+
+  // If both numbers lie within the [2^-450, 2^450] interval, their squares can neither overflow nor
+  // underflow, so no scaling is needed. This is by far the most common case.
+  int exponent = 0;
+  double larger_scaled = larger;
+  double smaller_scaled = smaller;
+  if (larger > internal::constexpr_power_of_two(450)
+      || smaller < internal::constexpr_power_of_two(-450)) {
+    // If the smaller number is less than 2^-60 times the larger number, its contribution is below
+    // the rounding error of the larger number.
+    exponent = internal::constexpr_exponent(larger);
+    if (exponent - internal::constexpr_exponent(smaller) > 60) {
+      return larger;
+    }
+
+    // Scale both numbers by the same power of 2 such that the larger one falls within the [1, 2[
+    // interval, which prevents the squares from overflowing or underflowing. Scaling is exact.
+    larger_scaled = internal::constexpr_scale(larger, -exponent);
+    smaller_scaled = internal::constexpr_scale(smaller, -exponent);
+  }
+
+  const internal::constexpr_double_double sum_of_squares =
+      internal::constexpr_add(internal::constexpr_two_product(larger_scaled, larger_scaled),
+                              internal::constexpr_two_product(smaller_scaled, smaller_scaled));
+
+  // Take the square root and apply a Newton-Raphson correction whose residual is computed exactly.
+  double root = constexpr_sqrt(sum_of_squares.high);
+  const internal::constexpr_double_double square = internal::constexpr_two_product(root, root);
+  const internal::constexpr_double_double residual =
+      internal::constexpr_add(sum_of_squares, {-square.high, -square.low});
+  root += residual.high / (2.0 * root);
+
+  if (exponent == 0) {
+    return root;
+  }
+
+  // The scaled root lies within the [1, 2 * sqrt(2)] interval, so re-applying the factor of 2^e
+  // overflows if and only if e is 1023 and the scaled root is at least 2.
+  if (exponent == 1023 && root >= 2.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return internal::constexpr_scale(root, exponent);
+}
+
+// Returns the inverse square root of a double-precision floating-point number, 1 / sqrt(x). This
+// function is a constant expression. When evaluated at compile time, returns the same result as
+// 1.0 / std::sqrt to within one unit in the last place (1 ULP). The inverse square root of a
+// negative number or of NaN is NaN, that of zero is infinity with the same sign, and that of
+// positive infinity is zero.
+[[nodiscard]] inline constexpr double constexpr_rsqrt(const double number) {
+  // The inverse square root of zero is infinity with the same sign. Notably, dividing by zero is
+  // not a constant expression, so this value must be treated separately.
+  if (number == 0.0) {
+    return std::signbit(number) ? -std::numeric_limits<double>::infinity()
+                                : std::numeric_limits<double>::infinity();
+  }
+
+  // The inverse square root of a negative number or of an undefined number is undefined.
+  if (number < 0.0 || std::isnan(number)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  // The inverse square root of positive infinity is zero.
+  if (number == std::numeric_limits<double>::infinity()) {
+    return 0.0;
+  }
+
+  // Factor the number as x = m * 4^q, where m is within the [1, 4[ interval, such that
+  // 1 / sqrt(x) = 2^(-q) / sqrt(m). This prevents the residual below from overflowing or
+  // underflowing.
+  const int exponent = internal::constexpr_exponent(number);
+  const int half_exponent = exponent >= 0 ? exponent / 2 : -((-exponent + 1) / 2);
+  const double mantissa = internal::constexpr_scale(number, -2 * half_exponent);
+
+  // Take the reciprocal of the square root, then apply a Newton-Raphson correction whose residual
+  // 1 - m * root^2 is computed exactly.
+  double root = 1.0 / constexpr_sqrt(mantissa);
+  const internal::constexpr_double_double product =
+      internal::constexpr_multiply(internal::constexpr_two_product(root, root), {mantissa, 0.0});
+  const internal::constexpr_double_double residual =
+      internal::constexpr_add({1.0, 0.0}, {-product.high, -product.low});
+  root += 0.5 * root * residual.high;
+
+  return internal::constexpr_scale(root, -half_exponent);
+}
+
+// Returns the base-e exponential of a double-precision floating-point number. This function is a
+// constant expression, unlike std::exp. When evaluated at compile time, returns the same result as
+// std::exp to within one unit in the last place (1 ULP). The exponential of NaN is NaN, that of
+// positive infinity is positive infinity, and that of negative infinity is zero. Results that are
+// too large to be represented overflow to positive infinity, and results that are too small
+// underflow to zero.
+[[nodiscard]] inline constexpr double constexpr_exp(const double number) {
+  if (std::isnan(number)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  if (number == std::numeric_limits<double>::infinity()) {
+    return number;
+  }
+
+  if (number == -std::numeric_limits<double>::infinity()) {
+    return 0.0;
+  }
+
+  return internal::constexpr_exp_solver({number, 0.0});
+}
+
+// Returns the natural (base-e) logarithm of a double-precision floating-point number. This function
+// is a constant expression, unlike std::log. When evaluated at compile time, returns the same
+// result as std::log to within one unit in the last place (1 ULP). The logarithm of a negative
+// number or of NaN is NaN, that of zero is negative infinity, and that of positive infinity is
+// positive infinity.
+[[nodiscard]] inline constexpr double constexpr_log(const double number) {
+  if (number < 0.0 || std::isnan(number)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  if (number == 0.0) {
+    return -std::numeric_limits<double>::infinity();
+  }
+
+  if (number == std::numeric_limits<double>::infinity()) {
+    return number;
+  }
+
+  return internal::constexpr_log_solver(number).high;
+}
+
+// Returns a double-precision floating-point number raised to the power of another. This function is
+// a constant expression, unlike std::pow. When evaluated at compile time, returns the same result
+// as std::pow to within one unit in the last place (1 ULP). Special cases, such as NaN, infinite,
+// and zero arguments and negative bases, are handled as specified by Annex F of the C standard, as
+// is the case for std::pow. In particular, a negative base raised to a non-integer power is NaN.
+[[nodiscard]] inline constexpr double constexpr_pow(const double base, const double exponent) {
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+
+  // Any number raised to the power of zero is one, and one raised to any power is one, even if the
+  // other argument is NaN.
+  if (exponent == 0.0 || base == 1.0) {
+    return 1.0;
+  }
+
+  if (std::isnan(base) || std::isnan(exponent)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const bool base_is_negative = std::signbit(base);
+  const double base_magnitude = base_is_negative ? -base : base;
+
+  // Handle an infinite exponent. The result only depends on whether the base's magnitude is less
+  // than or greater than one.
+  if (exponent == infinity || exponent == -infinity) {
+    if (base_magnitude == 1.0) {
+      return 1.0;
+    }
+    return (base_magnitude < 1.0) == (exponent < 0.0) ? infinity : 0.0;
+  }
+
+  // A negative base raised to an odd integer power has a negative sign. Note that zero and infinity
+  // also carry a sign.
+  const bool exponent_is_odd_integer = internal::constexpr_is_odd_integer(exponent);
+  const bool result_is_negative = base_is_negative && exponent_is_odd_integer;
+
+  // Handle a zero or infinite base.
+  if (base_magnitude == 0.0 || base_magnitude == infinity) {
+    const double magnitude = (base_magnitude == 0.0) == (exponent < 0.0) ? infinity : 0.0;
+    return result_is_negative ? -magnitude : magnitude;
+  }
+
+  // A negative finite base raised to a non-integer finite power is undefined.
+  if (base_is_negative && !internal::constexpr_is_integer(exponent)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  // A base of -1 raised to an integer power is either one or minus one. This must be handled
+  // separately, since the case below does not apply to it.
+  if (base_magnitude == 1.0) {
+    return result_is_negative ? -1.0 : 1.0;
+  }
+
+  // Any base other than one raised to a power of magnitude 2^64 or more overflows or underflows,
+  // since the magnitude of the logarithm of the base is at least about 2^-53.
+  double magnitude = 0.0;
+  if (exponent >= 18446744073709551616.0 || exponent <= -18446744073709551616.0) {
+    magnitude = (base_magnitude < 1.0) == (exponent < 0.0) ? infinity : 0.0;
+  } else {
+    // Compute x^y = exp(y * ln(x)). The logarithm and the product are computed in double-double
+    // precision, since the rounding error of the product is magnified by the exponential.
+    magnitude = internal::constexpr_exp_solver(internal::constexpr_multiply(
+        internal::constexpr_log_solver(base_magnitude), {exponent, 0.0}));
+  }
+  return result_is_negative ? -magnitude : magnitude;
+}
+
+}  // namespace utility
+
+#endif  // CPP_UTILITIES_CONSTEXPR_MATH_HPP
@@ -0,0 +1,242 @@
+// Copyright 2023 Alexandre Coderre-Chabot
+//
+// This file is licensed under the MIT license. For more information, visit:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//   substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//   BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// This file was originally obtained from:
+//     https://github.com/acodcha/cpp-utilities
+
+#ifndef CPP_UTILITIES_CONSTEXPR_TABLE_HPP
+#define CPP_UTILITIES_CONSTEXPR_TABLE_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "constexpr_sqrt.hpp"
+
+// Namespace that encompasses all of the C++ Utilities library's content.
+namespace utility {
+
+// Namespace that contains internal implementation details of the C++ Utilities library. Content
+// within this namespace is not meant to be used except by the the C++ Utilities library's own
+// functions and classes.
+namespace internal {
+
+// Returns the sample point at the given index of a table of the given size whose samples are evenly
+// spaced over the [minimum, maximum] interval. The first and last sample points are exactly equal
+// to the minimum and maximum, respectively. This function is an internal implementation detail and
+// is not intended to be used except by the C++ Utilities library's table functions.
+template <std::size_t Size>
+[[nodiscard]] inline constexpr double constexpr_table_sample(
+    const std::size_t index, const double minimum, const double maximum) {
+  static_assert(Size >= 2, "A table must contain at least two entries.");
+  const double fraction = static_cast<double>(index) / static_cast<double>(Size - 1);
+  return minimum * (1.0 - fraction) + maximum * fraction;
+}
+
+// Returns the fractional position of a number within a table of the given size whose samples are
+// evenly spaced over the [minimum, maximum] interval. The number is clamped to this interval, such
+// that the returned position lies within the [0, Size - 1] interval. The minimum must be less than
+// the maximum; otherwise, the returned position is meaningless. This function is an internal
+// implementation detail and is not intended to be used except by the C++ Utilities library's table
+// interpolation functions.
+template <std::size_t Size>
+[[nodiscard]] inline constexpr double constexpr_table_position(
+    const double number, const double minimum, const double maximum) {
+  static_assert(Size >= 2, "A table must contain at least two entries.");
+  if (number <= minimum) {
+    return 0.0;
+  }
+  if (number >= maximum) {
+    return static_cast<double>(Size - 1);
+  }
+  return (number - minimum) / (maximum - minimum) * static_cast<double>(Size - 1);
+}
+
+// Returns the inverse square root of a double-precision floating-point number. This function is a
+// constant expression. It handles special cases in the same way as utility::constexpr_rsqrt, but it
+// is cheaper to evaluate at compile time, which allows larger tables. This function is an internal
+// implementation detail and is not intended to be used except by the
+// utility::constexpr_inverse_sqrt_table function.
+[[nodiscard]] inline constexpr double constexpr_inverse_sqrt(const double number) {
+  // The inverse square root of zero is infinity with the same sign, as is 1.0 / std::sqrt(-0.0).
+  // Notably, dividing by zero is not a constant expression, so this value must be treated
+  // separately.
+  if (number == 0.0) {
+    return std::signbit(number) ? -std::numeric_limits<double>::infinity()
+                                : std::numeric_limits<double>::infinity();
+  }
+
+  // The inverse square root of a negative number or of an undefined number is undefined.
+  if (number < 0.0 || std::isnan(number)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  return 1.0 / constexpr_sqrt(number);
+}
+
+}  // namespace internal
+
+// Returns a lookup table of the given size whose entries are the values of the given function
+// evaluated at sample points evenly spaced over the [minimum, maximum] interval. The first entry
+// corresponds to the minimum and the last entry corresponds to the maximum. The function must be a
+// constant expression that takes a double-precision floating-point number and returns a
+// double-precision floating-point number. When this function is used to initialize a constexpr
+// variable, the table is computed entirely at compile time.
+template <std::size_t Size, class Function>
+[[nodiscard]] inline constexpr std::array<double, Size> make_constexpr_table(
+    const Function& function, const double minimum, const double maximum) {
+  std::array<double, Size> table{};
+  for (std::size_t index = 0; index < Size; ++index) {
+    table[index] = function(internal::constexpr_table_sample<Size>(index, minimum, maximum));
+  }
+  return table;
+}
+
+// Returns a two-dimensional lookup table with the given number of rows and columns whose entries
+// are the values of the given function evaluated on a grid of sample points. The columns are evenly
+// spaced over the [x_minimum, x_maximum] interval and the rows are evenly spaced over the
+// [y_minimum, y_maximum] interval, such that the entry at table[row][column] is the value of the
+// function at the sample point (x, y) of that column and row. The function must be a constant
+// expression that takes two double-precision floating-point numbers and returns a double-precision
+// floating-point number. When this function is used to initialize a constexpr variable, the table
+// is computed entirely at compile time.
+template <std::size_t Rows, std::size_t Columns, class Function>
+[[nodiscard]] inline constexpr std::array<std::array<double, Columns>, Rows> make_constexpr_grid(
+    const Function& function, const double x_minimum, const double x_maximum,
+    const double y_minimum, const double y_maximum) {
+  std::array<std::array<double, Columns>, Rows> table{};
+  for (std::size_t row = 0; row < Rows; ++row) {
+    const double y = internal::constexpr_table_sample<Rows>(row, y_minimum, y_maximum);
+    for (std::size_t column = 0; column < Columns; ++column) {
+      table[row][column] =
+          function(internal::constexpr_table_sample<Columns>(column, x_minimum, x_maximum), y);
+    }
+  }
+  return table;
+}
+
+// Returns the value of a lookup table at the given number using linear interpolation between the
+// two nearest entries. The table's entries must correspond to sample points evenly spaced over the
+// [minimum, maximum] interval, as is the case for tables returned by utility::make_constexpr_table.
+// The minimum must be less than the maximum. Numbers outside of this interval are clamped to its
+// endpoints. Returns NaN if the number is NaN, or if either of the two nearest entries is infinite.
+template <std::size_t Size>
+[[nodiscard]] inline constexpr double constexpr_table_interpolate(
+    const std::array<double, Size>& table, const double minimum, const double maximum,
+    const double number) {
+  if (std::isnan(number)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const double position = internal::constexpr_table_position<Size>(number, minimum, maximum);
+  const std::size_t index = static_cast<std::size_t>(position);
+
+  // The last entry has no successor, so it is returned as is.
+  if (index >= Size - 1) {
+    return table[Size - 1];
+  }
+
+  const double fraction = position - static_cast<double>(index);
+  return table[index] + fraction * (table[index + 1] - table[index]);
+}
+
+// Returns the value of a two-dimensional lookup table at the given point using bilinear
+// interpolation between the four nearest entries. The table's columns and rows must correspond to
+// sample points evenly spaced over the [x_minimum, x_maximum] and [y_minimum, y_maximum] intervals,
+// respectively, as is the case for tables returned by utility::make_constexpr_grid. The minimums
+// must be less than the maximums. Coordinates outside of these intervals are clamped to their
+// endpoints. Returns NaN if either coordinate is NaN, or if any of the four nearest entries is
+// infinite.
+template <std::size_t Rows, std::size_t Columns>
+[[nodiscard]] inline constexpr double constexpr_grid_interpolate(
+    const std::array<std::array<double, Columns>, Rows>& table, const double x_minimum,
+    const double x_maximum, const double y_minimum, const double y_maximum, const double x,
+    const double y) {
+  if (std::isnan(x) || std::isnan(y)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const double column_position =
+      internal::constexpr_table_position<Columns>(x, x_minimum, x_maximum);
+  const double row_position = internal::constexpr_table_position<Rows>(y, y_minimum, y_maximum);
+
+  // Select the lower-left entry of the grid cell that contains the point. On the last column or
+  // row, the cell before it is used instead, which yields a fraction of exactly one.
+  std::size_t column = static_cast<std::size_t>(column_position);
+  if (column >= Columns - 1) {
+    column = Columns - 2;
+  }
+  std::size_t row = static_cast<std::size_t>(row_position);
+  if (row >= Rows - 1) {
+    row = Rows - 2;
+  }
+
+  const double column_fraction = column_position - static_cast<double>(column);
+  const double row_fraction = row_position - static_cast<double>(row);
+  const double lower = table[row][column]
+                       + column_fraction * (table[row][column + 1] - table[row][column]);
+  const double upper = table[row + 1][column]
+                       + column_fraction * (table[row + 1][column + 1] - table[row + 1][column]);
+  return lower + row_fraction * (upper - lower);
+}
+
+// Returns a lookup table of the given size whose entries are the square roots of sample points
+// evenly spaced over the [minimum, maximum] interval. The table is computed with
+// utility::constexpr_sqrt, so it can be computed entirely at compile time.
+template <std::size_t Size>
+[[nodiscard]] inline constexpr std::array<double, Size> constexpr_sqrt_table(
+    const double minimum, const double maximum) {
+  return make_constexpr_table<Size>(
+      [](const double number) { return constexpr_sqrt(number); }, minimum, maximum);
+}
+
+// Returns a lookup table of the given size whose entries are the inverse square roots of sample
+// points evenly spaced over the [minimum, maximum] interval. The inverse square root of zero is
+// infinity with the same sign as the zero, as for utility::constexpr_rsqrt, so if the minimum is
+// zero, the first entry is infinite and the table cannot be interpolated within its first cell:
+// utility::constexpr_table_interpolate returns NaN for numbers between the first and second sample
+// points. Use a positive minimum if the table is to be interpolated near zero. The table is
+// computed with utility::constexpr_sqrt, so it can be computed entirely at compile time.
+template <std::size_t Size>
+[[nodiscard]] inline constexpr std::array<double, Size> constexpr_inverse_sqrt_table(
+    const double minimum, const double maximum) {
+  return make_constexpr_table<Size>(
+      [](const double number) { return internal::constexpr_inverse_sqrt(number); }, minimum,
+      maximum);
+}
+
+// Returns a two-dimensional lookup table with the given number of rows and columns whose entries
+// are the Euclidean distances sqrt(x^2 + y^2) from the origin to the points of a grid. The columns
+// are evenly spaced over the [x_minimum, x_maximum] interval and the rows are evenly spaced over
+// the [y_minimum, y_maximum] interval. For example, a table of grid cell distances for a grid with
+// unit spacing is obtained with utility::constexpr_hypot_grid<N, N>(0.0, N - 1.0, 0.0, N - 1.0).
+// The table is computed with utility::constexpr_sqrt, so it can be computed entirely at compile
+// time. The squares of the coordinates must not overflow.
+template <std::size_t Rows, std::size_t Columns>
+[[nodiscard]] inline constexpr std::array<std::array<double, Columns>, Rows> constexpr_hypot_grid(
+    const double x_minimum, const double x_maximum, const double y_minimum,
+    const double y_maximum) {
+  return make_constexpr_grid<Rows, Columns>(
+      [](const double x, const double y) { return constexpr_sqrt(x * x + y * y); }, x_minimum,
+      x_maximum, y_minimum, y_maximum);
+}
+
+}  // namespace utility
+
+#endif  // CPP_UTILITIES_CONSTEXPR_TABLE_HPP
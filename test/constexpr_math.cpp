@@ -0,0 +1,497 @@
+// Copyright 2023 Alexandre Coderre-Chabot
+//
+// This file is licensed under the MIT license. For more information, visit:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//   substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//   BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// This file was originally obtained from:
+//     https://github.com/acodcha/cpp-utilities
+
+#include "../include/cpp-utilities/constexpr_math.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace utility {
+
+namespace {
+
+// The constant expression math functions only guarantee their accuracy and their handling of NaN,
+// infinite, and subnormal numbers when they are evaluated at compile time or when the calling code
+// is compiled with strict IEEE 754 floating-point arithmetic. This test is built without fast math,
+// so both cases are tested: the compile-time sweeps compute their results at compile time and the
+// run-time sweeps compute theirs at run time. Both are compared against the C++ Standard Library.
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+constexpr double not_a_number = std::numeric_limits<double>::quiet_NaN();
+
+// Number of inputs in each one-dimensional sweep. Each sweep is computed at compile time, so its
+// size is bounded by the compiler's constant expression evaluation limits.
+constexpr std::size_t sweep_size = 4096;
+
+// Number of inputs along each dimension of each two-dimensional sweep.
+constexpr std::size_t grid_size = 64;
+
+// Returns the results of a function for each index of a sweep of the given size. When used to
+// initialize a constexpr variable, the results are computed at compile time.
+template <std::size_t Size, class Function>
+constexpr std::array<double, Size> make_sweep(const Function& function) {
+  std::array<double, Size> results{};
+  for (std::size_t index = 0; index < Size; ++index) {
+    results[index] = function(index);
+  }
+  return results;
+}
+
+// Returns a number evenly spaced within the [minimum, maximum] interval, given an index within a
+// sweep of the given size.
+template <std::size_t Size>
+constexpr double linear_sample(
+    const std::size_t index, const double minimum, const double maximum) {
+  return minimum
+         + (maximum - minimum) * static_cast<double>(index) / static_cast<double>(Size - 1);
+}
+
+// Inputs evenly spaced on a logarithmic scale within the [e^-700, e^700] interval.
+constexpr std::array<double, sweep_size> logarithmic_inputs = make_sweep<sweep_size>(
+    [](const std::size_t index) {
+      return constexpr_exp(linear_sample<sweep_size>(index, -700.0, 700.0));
+    });
+
+// Inputs evenly spaced on a logarithmic scale within the [e^-700, e^700] interval, for grids.
+constexpr std::array<double, grid_size> logarithmic_grid_inputs = make_sweep<grid_size>(
+    [](const std::size_t index) {
+      return constexpr_exp(linear_sample<grid_size>(index, -700.0, 700.0));
+    });
+
+// Returns the distance between two finite double-precision floating-point numbers in units in the
+// last place (ULP), which is the number of representable numbers between them.
+std::int64_t ulp_distance(const double first, const double second) {
+  std::int64_t first_bits = 0;
+  std::int64_t second_bits = 0;
+  std::memcpy(&first_bits, &first, sizeof(double));
+  std::memcpy(&second_bits, &second, sizeof(double));
+
+  // Map the sign-magnitude representation to a monotonic integer representation.
+  if (first_bits < 0) {
+    first_bits = std::numeric_limits<std::int64_t>::min() - first_bits;
+  }
+  if (second_bits < 0) {
+    second_bits = std::numeric_limits<std::int64_t>::min() - second_bits;
+  }
+  return first_bits >= second_bits ? first_bits - second_bits : second_bits - first_bits;
+}
+
+// Returns the cube root of a number computed in extended precision and rounded to double precision.
+// The double-precision std::cbrt of some implementations, such as that of glibc, is off by more
+// than 1 ULP, so this is used as the reference instead.
+double reference_cbrt(const double number) {
+  return static_cast<double>(std::cbrt(static_cast<long double>(number)));
+}
+
+TEST(ConstexprMath, ScaleCornerCases) {
+  // Exponents outside of the table of powers of 2 underflow or overflow rather than indexing
+  // outside of the table.
+  static_assert(
+      internal::constexpr_power_of_two(-1074) == std::numeric_limits<double>::denorm_min());
+  static_assert(internal::constexpr_power_of_two(-1075) == 0.0);
+  static_assert(internal::constexpr_power_of_two(std::numeric_limits<int>::min()) == 0.0);
+  static_assert(internal::constexpr_power_of_two(1024) == infinity);
+  static_assert(internal::constexpr_power_of_two(std::numeric_limits<int>::max()) == infinity);
+  static_assert(internal::constexpr_scale(1.0, std::numeric_limits<int>::min()) == 0.0);
+  static_assert(internal::constexpr_scale(std::numeric_limits<double>::max(), -2098)
+                == std::numeric_limits<double>::denorm_min());
+  static_assert(
+      internal::constexpr_scale(std::numeric_limits<double>::denorm_min(), 2097) == 0x1p1023);
+
+  // Scaling a number slightly greater than 1/2 down to half of the smallest subnormal number rounds
+  // up to the smallest subnormal number. Scaling it to the subnormal range first would round it to
+  // exactly 2^-1023, after which the final halving would round to zero instead.
+  static_assert(internal::constexpr_scale(0x1.0000000000001p-1, -1074)
+                == std::numeric_limits<double>::denorm_min());
+}
+
+TEST(ConstexprMath, CbrtCornerCases) {
+  static_assert(std::isnan(constexpr_cbrt(not_a_number)));
+  static_assert(constexpr_cbrt(0.0) == 0.0 && !std::signbit(constexpr_cbrt(0.0)));
+  static_assert(constexpr_cbrt(-0.0) == 0.0 && std::signbit(constexpr_cbrt(-0.0)));
+  static_assert(constexpr_cbrt(infinity) == infinity);
+  static_assert(constexpr_cbrt(-infinity) == -infinity);
+  static_assert(constexpr_cbrt(27.0) == 3.0);
+  static_assert(constexpr_cbrt(-8.0) == -2.0);
+  static_assert(constexpr_cbrt(std::numeric_limits<double>::denorm_min())
+                == 1.7031839360032603e-108);
+
+  constexpr double maximum = constexpr_cbrt(std::numeric_limits<double>::max());
+  EXPECT_LE(ulp_distance(maximum, reference_cbrt(std::numeric_limits<double>::max())), 1);
+
+  constexpr double minimum = constexpr_cbrt(std::numeric_limits<double>::min());
+  EXPECT_LE(ulp_distance(minimum, reference_cbrt(std::numeric_limits<double>::min())), 1);
+}
+
+TEST(ConstexprMath, CbrtSweep) {
+  constexpr std::array<double, sweep_size> results = make_sweep<sweep_size>(
+      [](const std::size_t index) { return constexpr_cbrt(logarithmic_inputs[index]); });
+  constexpr std::array<double, sweep_size> negative_results = make_sweep<sweep_size>(
+      [](const std::size_t index) { return constexpr_cbrt(-logarithmic_inputs[index]); });
+  for (std::size_t index = 0; index < sweep_size; ++index) {
+    const double number = logarithmic_inputs[index];
+    EXPECT_LE(ulp_distance(results[index], reference_cbrt(number)), 1) << number;
+    EXPECT_LE(ulp_distance(negative_results[index], reference_cbrt(-number)), 1) << -number;
+  }
+}
+
+TEST(ConstexprMath, HypotCornerCases) {
+  static_assert(std::isnan(constexpr_hypot(not_a_number, 1.0)));
+  static_assert(std::isnan(constexpr_hypot(1.0, not_a_number)));
+  static_assert(constexpr_hypot(not_a_number, infinity) == infinity);
+  static_assert(constexpr_hypot(-infinity, not_a_number) == infinity);
+  static_assert(constexpr_hypot(-infinity, 1.0) == infinity);
+  static_assert(constexpr_hypot(0.0, 0.0) == 0.0);
+  static_assert(constexpr_hypot(-3.0, 0.0) == 3.0);
+  static_assert(constexpr_hypot(-3.0, -4.0) == 5.0);
+  static_assert(constexpr_hypot(1.0e300, 1.0e-300) == 1.0e300);
+  static_assert(constexpr_hypot(std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::max())
+                == infinity);
+  static_assert(constexpr_hypot(3.0e-320, 4.0e-320) == 5.0e-320);
+
+  constexpr double large = constexpr_hypot(3.0e300, 4.0e300);
+  EXPECT_LE(ulp_distance(large, std::hypot(3.0e300, 4.0e300)), 1);
+}
+
+TEST(ConstexprMath, HypotSweep) {
+  constexpr std::array<double, grid_size * grid_size> results =
+      make_sweep<grid_size * grid_size>([](const std::size_t index) {
+        return constexpr_hypot(logarithmic_grid_inputs[index / grid_size],
+                               -logarithmic_grid_inputs[index % grid_size]);
+      });
+  for (std::size_t index = 0; index < grid_size * grid_size; ++index) {
+    const double first = logarithmic_grid_inputs[index / grid_size];
+    const double second = -logarithmic_grid_inputs[index % grid_size];
+    EXPECT_LE(ulp_distance(results[index], std::hypot(first, second)), 1)
+        << first << ", " << second;
+  }
+}
+
+TEST(ConstexprMath, RsqrtCornerCases) {
+  static_assert(std::isnan(constexpr_rsqrt(not_a_number)));
+  static_assert(std::isnan(constexpr_rsqrt(-infinity)));
+  static_assert(std::isnan(constexpr_rsqrt(-2.0)));
+  static_assert(constexpr_rsqrt(0.0) == infinity);
+  static_assert(constexpr_rsqrt(-0.0) == -infinity);
+  static_assert(constexpr_rsqrt(infinity) == 0.0);
+  static_assert(constexpr_rsqrt(1.0) == 1.0);
+  static_assert(constexpr_rsqrt(0.25) == 2.0);
+  static_assert(constexpr_rsqrt(4.0) == 0.5);
+  static_assert(constexpr_rsqrt(std::numeric_limits<double>::denorm_min())
+                == 4.4989137945431964e+161);
+
+  constexpr double maximum = constexpr_rsqrt(std::numeric_limits<double>::max());
+  EXPECT_LE(ulp_distance(maximum, 1.0 / std::sqrt(std::numeric_limits<double>::max())), 1);
+}
+
+TEST(ConstexprMath, RsqrtSweep) {
+  constexpr std::array<double, sweep_size> results = make_sweep<sweep_size>(
+      [](const std::size_t index) { return constexpr_rsqrt(logarithmic_inputs[index]); });
+  for (std::size_t index = 0; index < sweep_size; ++index) {
+    const double number = logarithmic_inputs[index];
+    EXPECT_LE(ulp_distance(results[index], 1.0 / std::sqrt(number)), 1) << number;
+  }
+}
+
+TEST(ConstexprMath, ExpCornerCases) {
+  static_assert(std::isnan(constexpr_exp(not_a_number)));
+  static_assert(constexpr_exp(infinity) == infinity);
+  static_assert(constexpr_exp(-infinity) == 0.0);
+  static_assert(constexpr_exp(0.0) == 1.0);
+  static_assert(constexpr_exp(710.0) == infinity);
+  static_assert(constexpr_exp(709.79) == infinity);
+  static_assert(constexpr_exp(-746.0) == 0.0);
+  static_assert(constexpr_exp(-745.0) == std::numeric_limits<double>::denorm_min());
+  static_assert(constexpr_exp(-740.0) == 4.2e-322);
+
+  constexpr double maximum = constexpr_exp(709.78);
+  EXPECT_LE(ulp_distance(maximum, std::exp(709.78)), 1);
+}
+
+TEST(ConstexprMath, ExpSweep) {
+  constexpr std::array<double, sweep_size> results =
+      make_sweep<sweep_size>([](const std::size_t index) {
+        return constexpr_exp(linear_sample<sweep_size>(index, -708.0, 709.78));
+      });
+  constexpr std::array<double, sweep_size> small_results =
+      make_sweep<sweep_size>([](const std::size_t index) {
+        return constexpr_exp(linear_sample<sweep_size>(index, -1.0, 1.0));
+      });
+  constexpr std::array<double, sweep_size> inputs = make_sweep<sweep_size>(
+      [](const std::size_t index) { return linear_sample<sweep_size>(index, -708.0, 709.78); });
+  constexpr std::array<double, sweep_size> small_inputs = make_sweep<sweep_size>(
+      [](const std::size_t index) { return linear_sample<sweep_size>(index, -1.0, 1.0); });
+  for (std::size_t index = 0; index < sweep_size; ++index) {
+    EXPECT_LE(ulp_distance(results[index], std::exp(inputs[index])), 1) << inputs[index];
+    EXPECT_LE(ulp_distance(small_results[index], std::exp(small_inputs[index])), 1)
+        << small_inputs[index];
+  }
+}
+
+TEST(ConstexprMath, LogCornerCases) {
+  static_assert(std::isnan(constexpr_log(not_a_number)));
+  static_assert(std::isnan(constexpr_log(-infinity)));
+  static_assert(std::isnan(constexpr_log(-2.0)));
+  static_assert(constexpr_log(0.0) == -infinity);
+  static_assert(constexpr_log(-0.0) == -infinity);
+  static_assert(constexpr_log(infinity) == infinity);
+  static_assert(constexpr_log(1.0) == 0.0);
+  static_assert(constexpr_log(std::numeric_limits<double>::denorm_min()) == -744.4400719213812);
+  static_assert(constexpr_log(1.0e-320) == -736.8272408909739);
+
+  constexpr double maximum = constexpr_log(std::numeric_limits<double>::max());
+  EXPECT_LE(ulp_distance(maximum, std::log(std::numeric_limits<double>::max())), 1);
+
+  constexpr double minimum = constexpr_log(std::numeric_limits<double>::min());
+  EXPECT_LE(ulp_distance(minimum, std::log(std::numeric_limits<double>::min())), 1);
+}
+
+TEST(ConstexprMath, LogSweep) {
+  constexpr std::array<double, sweep_size> results = make_sweep<sweep_size>(
+      [](const std::size_t index) { return constexpr_log(logarithmic_inputs[index]); });
+  constexpr std::array<double, sweep_size> near_one_results =
+      make_sweep<sweep_size>([](const std::size_t index) {
+        return constexpr_log(linear_sample<sweep_size>(index, 0.5, 2.0));
+      });
+  constexpr std::array<double, sweep_size> near_one_inputs = make_sweep<sweep_size>(
+      [](const std::size_t index) { return linear_sample<sweep_size>(index, 0.5, 2.0); });
+  for (std::size_t index = 0; index < sweep_size; ++index) {
+    const double number = logarithmic_inputs[index];
+    EXPECT_LE(ulp_distance(results[index], std::log(number)), 1) << number;
+    EXPECT_LE(ulp_distance(near_one_results[index], std::log(near_one_inputs[index])), 1)
+        << near_one_inputs[index];
+  }
+}
+
+TEST(ConstexprMath, PowCornerCases) {
+  static_assert(constexpr_pow(not_a_number, 0.0) == 1.0);
+  static_assert(constexpr_pow(1.0, not_a_number) == 1.0);
+  static_assert(std::isnan(constexpr_pow(not_a_number, 1.0)));
+  static_assert(std::isnan(constexpr_pow(2.0, not_a_number)));
+  static_assert(std::isnan(constexpr_pow(-2.0, 0.5)));
+
+  static_assert(constexpr_pow(0.0, -3.0) == infinity);
+  static_assert(constexpr_pow(-0.0, -3.0) == -infinity);
+  static_assert(constexpr_pow(-0.0, -2.0) == infinity);
+  static_assert(constexpr_pow(-0.0, -infinity) == infinity);
+  static_assert(constexpr_pow(-0.0, 3.0) == 0.0 && std::signbit(constexpr_pow(-0.0, 3.0)));
+  static_assert(constexpr_pow(-0.0, 2.0) == 0.0 && !std::signbit(constexpr_pow(-0.0, 2.0)));
+
+  static_assert(constexpr_pow(-1.0, infinity) == 1.0);
+  static_assert(constexpr_pow(-1.0, -infinity) == 1.0);
+  static_assert(constexpr_pow(0.5, -infinity) == infinity);
+  static_assert(constexpr_pow(2.0, -infinity) == 0.0);
+  static_assert(constexpr_pow(0.5, infinity) == 0.0);
+  static_assert(constexpr_pow(-2.0, infinity) == infinity);
+
+  static_assert(
+      constexpr_pow(-infinity, -3.0) == 0.0 && std::signbit(constexpr_pow(-infinity, -3.0)));
+  static_assert(constexpr_pow(-infinity, 3.0) == -infinity);
+  static_assert(constexpr_pow(-infinity, 2.0) == infinity);
+  static_assert(constexpr_pow(infinity, -0.5) == 0.0);
+  static_assert(constexpr_pow(infinity, 0.5) == infinity);
+
+  static_assert(constexpr_pow(2.0, 10.0) == 1024.0);
+  static_assert(constexpr_pow(-2.0, 3.0) == -8.0);
+  static_assert(constexpr_pow(-2.0, -2.0) == 0.25);
+  static_assert(constexpr_pow(2.0, -1074.0) == std::numeric_limits<double>::denorm_min());
+  static_assert(constexpr_pow(10.0, 400.0) == infinity);
+  static_assert(constexpr_pow(10.0, -400.0) == 0.0);
+  static_assert(constexpr_pow(2.0, 1.0e30) == infinity);
+  static_assert(constexpr_pow(0.5, 1.0e30) == 0.0);
+  static_assert(constexpr_pow(-1.0, 1.0e30) == 1.0);
+  static_assert(constexpr_pow(-1.0, -3.0) == -1.0);
+  static_assert(constexpr_pow(-1.0, -std::numeric_limits<double>::max()) == 1.0);
+
+  constexpr double large_exponent = constexpr_pow(1.0 + 1.0e-15, 1.0e17);
+  EXPECT_LE(ulp_distance(large_exponent, std::pow(1.0 + 1.0e-15, 1.0e17)), 1);
+}
+
+TEST(ConstexprMath, PowSweep) {
+  // Positive bases evenly spaced on a logarithmic scale raised to fractional exponents.
+  static constexpr std::array<double, grid_size> exponents = make_sweep<grid_size>(
+      [](const std::size_t index) { return linear_sample<grid_size>(index, -1.0, 1.0); });
+  constexpr std::array<double, grid_size * grid_size> results =
+      make_sweep<grid_size * grid_size>([](const std::size_t index) {
+        return constexpr_pow(
+            logarithmic_grid_inputs[index / grid_size], exponents[index % grid_size]);
+      });
+  for (std::size_t index = 0; index < grid_size * grid_size; ++index) {
+    const double base = logarithmic_grid_inputs[index / grid_size];
+    const double exponent = exponents[index % grid_size];
+    EXPECT_LE(ulp_distance(results[index], std::pow(base, exponent)), 1)
+        << base << ", " << exponent;
+  }
+
+  // Positive and negative bases raised to integer exponents, up to the largest finite results.
+  static constexpr std::array<double, grid_size> bases = make_sweep<grid_size>(
+      [](const std::size_t index) { return linear_sample<grid_size>(index, -4.0, 4.0); });
+  constexpr std::array<double, grid_size * grid_size> integer_results =
+      make_sweep<grid_size * grid_size>([](const std::size_t index) {
+        return constexpr_pow(
+            bases[index / grid_size], -500.0 + 16.0 * static_cast<double>(index % grid_size));
+      });
+  for (std::size_t index = 0; index < grid_size * grid_size; ++index) {
+    const double base = bases[index / grid_size];
+    const double exponent = -500.0 + 16.0 * static_cast<double>(index % grid_size);
+    EXPECT_LE(ulp_distance(integer_results[index], std::pow(base, exponent)), 1)
+        << base << ", " << exponent;
+  }
+}
+
+// Returns a number evenly spaced on a logarithmic scale within the [10^minimum, 10^maximum]
+// interval, given an index within a sweep of the given size. Unlike the inputs of the compile-time
+// sweeps, this is computed at run time.
+double logarithmic_sweep(
+    const int index, const int size, const double minimum, const double maximum) {
+  return std::pow(10.0, minimum + (maximum - minimum) * index / (size - 1));
+}
+
+// Returns a number evenly spaced on a linear scale within the [minimum, maximum] interval, given an
+// index within a sweep of the given size. Unlike the inputs of the compile-time sweeps, this is
+// computed at run time.
+double linear_sweep(const int index, const int size, const double minimum, const double maximum) {
+  return minimum + (maximum - minimum) * index / (size - 1);
+}
+
+// Returns whether two results are identical, including their signs, or are both NaN.
+bool same_result(const double first, const double second) {
+  if (std::isnan(first) || std::isnan(second)) {
+    return std::isnan(first) && std::isnan(second);
+  }
+  return first == second && std::signbit(first) == std::signbit(second);
+}
+
+TEST(ConstexprMath, RunTimeCornerCases) {
+  const std::array<double, 10> numbers{
+      not_a_number,
+      infinity,
+      -infinity,
+      0.0,
+      -0.0,
+      1.0,
+      -1.0,
+      -2.0,
+      std::numeric_limits<double>::denorm_min(),
+      std::numeric_limits<double>::max()};
+  for (const double number : numbers) {
+    if (std::isnan(number) || number == 0.0 || number == infinity || number == -infinity) {
+      EXPECT_TRUE(same_result(constexpr_cbrt(number), std::cbrt(number))) << number;
+      EXPECT_TRUE(same_result(constexpr_exp(number), std::exp(number))) << number;
+      EXPECT_TRUE(same_result(constexpr_log(number), std::log(number))) << number;
+    }
+    for (const double other : numbers) {
+      EXPECT_TRUE(same_result(constexpr_pow(number, other), std::pow(number, other)))
+          << number << ", " << other;
+      if (std::isnan(number) || std::isnan(other) || number == infinity || number == -infinity
+          || other == infinity || other == -infinity) {
+        EXPECT_TRUE(same_result(constexpr_hypot(number, other), std::hypot(number, other)))
+            << number << ", " << other;
+      }
+    }
+  }
+  EXPECT_TRUE(std::isnan(constexpr_rsqrt(not_a_number)));
+  EXPECT_TRUE(std::isnan(constexpr_rsqrt(-2.0)));
+  EXPECT_EQ(constexpr_rsqrt(infinity), 0.0);
+  EXPECT_EQ(constexpr_rsqrt(-0.0), -infinity);
+}
+
+TEST(ConstexprMath, RunTimeCbrtSweep) {
+  constexpr int size = 100000;
+  for (int index = 0; index < size; ++index) {
+    const double number = logarithmic_sweep(index, size, -320.0, 308.0);
+    EXPECT_LE(ulp_distance(constexpr_cbrt(number), reference_cbrt(number)), 1) << number;
+    EXPECT_LE(ulp_distance(constexpr_cbrt(-number), reference_cbrt(-number)), 1) << -number;
+  }
+}
+
+TEST(ConstexprMath, RunTimeHypotSweep) {
+  constexpr int size = 400;
+  for (int first_index = 0; first_index < size; ++first_index) {
+    const double first = logarithmic_sweep(first_index, size, -320.0, 308.0);
+    for (int second_index = 0; second_index < size; ++second_index) {
+      const double second = -logarithmic_sweep(second_index, size, -320.0, 308.0);
+      EXPECT_LE(ulp_distance(constexpr_hypot(first, second), std::hypot(first, second)), 1)
+          << first << ", " << second;
+    }
+  }
+}
+
+TEST(ConstexprMath, RunTimeRsqrtSweep) {
+  constexpr int size = 100000;
+  for (int index = 0; index < size; ++index) {
+    const double number = logarithmic_sweep(index, size, -320.0, 308.0);
+    EXPECT_LE(ulp_distance(constexpr_rsqrt(number), 1.0 / std::sqrt(number)), 1) << number;
+  }
+}
+
+TEST(ConstexprMath, RunTimeExpSweep) {
+  constexpr int size = 200000;
+  for (int index = 0; index < size; ++index) {
+    const double number = linear_sweep(index, size, -745.0, 709.78);
+    EXPECT_LE(ulp_distance(constexpr_exp(number), std::exp(number)), 1) << number;
+  }
+  for (int index = 0; index < size; ++index) {
+    const double number = linear_sweep(index, size, -1.0, 1.0);
+    EXPECT_LE(ulp_distance(constexpr_exp(number), std::exp(number)), 1) << number;
+  }
+}
+
+TEST(ConstexprMath, RunTimeLogSweep) {
+  constexpr int size = 200000;
+  for (int index = 0; index < size; ++index) {
+    const double number = logarithmic_sweep(index, size, -320.0, 308.0);
+    EXPECT_LE(ulp_distance(constexpr_log(number), std::log(number)), 1) << number;
+  }
+  for (int index = 0; index < size; ++index) {
+    const double number = linear_sweep(index, size, 0.5, 2.0);
+    EXPECT_LE(ulp_distance(constexpr_log(number), std::log(number)), 1) << number;
+  }
+}
+
+TEST(ConstexprMath, RunTimePowSweep) {
+  constexpr int size = 400;
+  for (int base_index = 0; base_index < size; ++base_index) {
+    const double base = logarithmic_sweep(base_index, size, -300.0, 300.0);
+    for (int exponent_index = 0; exponent_index < size; ++exponent_index) {
+      const double exponent = linear_sweep(exponent_index, size, -2.5, 2.5);
+      EXPECT_LE(ulp_distance(constexpr_pow(base, exponent), std::pow(base, exponent)), 1)
+          << base << ", " << exponent;
+    }
+  }
+  for (int base_index = 0; base_index < size; ++base_index) {
+    const double base = linear_sweep(base_index, size, -4.0, 4.0);
+    for (int exponent = -500; exponent <= 500; ++exponent) {
+      EXPECT_LE(ulp_distance(constexpr_pow(base, exponent), std::pow(base, exponent)), 1)
+          << base << ", " << exponent;
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace utility
@@ -0,0 +1,157 @@
+// Copyright 2023 Alexandre Coderre-Chabot
+//
+// This file is licensed under the MIT license. For more information, visit:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//   substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//   BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// This file was originally obtained from:
+//     https://github.com/acodcha/cpp-utilities
+
+#include "../include/cpp-utilities/constexpr_table.hpp"
+
+#include <gtest/gtest.h>
+
+namespace utility {
+
+namespace {
+
+constexpr std::array<double, 5> squares =
+    make_constexpr_table<5>([](const double number) { return number * number; }, 0.0, 4.0);
+
+constexpr std::array<double, 65> square_roots = constexpr_sqrt_table<65>(0.0, 16.0);
+
+constexpr std::array<double, 33> inverse_square_roots = constexpr_inverse_sqrt_table<33>(0.0, 8.0);
+
+constexpr std::array<std::array<double, 4>, 3> distances =
+    constexpr_hypot_grid<3, 4>(0.0, 3.0, 0.0, 2.0);
+
+// The tables above are constant expressions, so they are computed at compile time.
+static_assert(squares[4] == 16.0, "The table must be computed at compile time.");
+static_assert(square_roots[16] == 2.0, "The table must be computed at compile time.");
+static_assert(
+    distances[2][3] == constexpr_sqrt(13.0), "The table must be computed at compile time.");
+
+TEST(ConstexprTable, MakeConstexprTable) {
+  EXPECT_EQ(squares[0], 0.0);
+  EXPECT_EQ(squares[1], 1.0);
+  EXPECT_EQ(squares[2], 4.0);
+  EXPECT_EQ(squares[3], 9.0);
+  EXPECT_EQ(squares[4], 16.0);
+
+  constexpr std::array<double, 3> negative =
+      make_constexpr_table<3>([](const double number) { return -number; }, -1.0, 1.0);
+  EXPECT_EQ(negative[0], 1.0);
+  EXPECT_EQ(negative[1], 0.0);
+  EXPECT_EQ(negative[2], -1.0);
+}
+
+TEST(ConstexprTable, MakeConstexprGrid) {
+  constexpr std::array<std::array<double, 3>, 2> sums = make_constexpr_grid<2, 3>(
+      [](const double x, const double y) { return x + 10.0 * y; }, 0.0, 2.0, 0.0, 1.0);
+  EXPECT_EQ(sums[0][0], 0.0);
+  EXPECT_EQ(sums[0][1], 1.0);
+  EXPECT_EQ(sums[0][2], 2.0);
+  EXPECT_EQ(sums[1][0], 10.0);
+  EXPECT_EQ(sums[1][1], 11.0);
+  EXPECT_EQ(sums[1][2], 12.0);
+}
+
+TEST(ConstexprTable, ConstexprTableInterpolate) {
+  EXPECT_TRUE(std::isnan(
+      constexpr_table_interpolate(squares, 0.0, 4.0, std::numeric_limits<double>::quiet_NaN())));
+
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, -1.0), 0.0);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 0.0), 0.0);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 0.5), 0.5);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 1.0), 1.0);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 2.5), 6.5);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 3.75), 14.25);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 4.0), 16.0);
+  EXPECT_EQ(constexpr_table_interpolate(squares, 0.0, 4.0, 5.0), 16.0);
+
+  constexpr double interpolated = constexpr_table_interpolate(squares, 0.0, 4.0, 1.5);
+  EXPECT_EQ(interpolated, 2.5);
+}
+
+TEST(ConstexprTable, ConstexprGridInterpolate) {
+  EXPECT_TRUE(std::isnan(constexpr_grid_interpolate(
+      distances, 0.0, 3.0, 0.0, 2.0, std::numeric_limits<double>::quiet_NaN(), 0.0)));
+
+  EXPECT_TRUE(std::isnan(constexpr_grid_interpolate(
+      distances, 0.0, 3.0, 0.0, 2.0, 0.0, std::numeric_limits<double>::quiet_NaN())));
+
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 0.0, 0.0), 0.0);
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 2.0, 0.0), 2.0);
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 2.5, 0.0), 2.5);
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 3.0, 2.0), distances[2][3]);
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 9.0, 9.0), distances[2][3]);
+  EXPECT_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, -1.0, -1.0), 0.0);
+  EXPECT_DOUBLE_EQ(constexpr_grid_interpolate(distances, 0.0, 3.0, 0.0, 2.0, 0.5, 0.5),
+                   0.25 * (distances[0][0] + distances[0][1] + distances[1][0] + distances[1][1]));
+}
+
+TEST(ConstexprTable, ConstexprSqrtTable) {
+  for (std::size_t index = 0; index < square_roots.size(); ++index) {
+    const double number = 0.25 * static_cast<double>(index);
+    EXPECT_DOUBLE_EQ(square_roots[index], std::sqrt(number));
+  }
+}
+
+TEST(ConstexprTable, ConstexprInverseSqrtTable) {
+  // Zeros are handled in the same way as by utility::constexpr_rsqrt and by 1.0 / std::sqrt.
+  static_assert(internal::constexpr_inverse_sqrt(0.0) == std::numeric_limits<double>::infinity());
+  static_assert(
+      internal::constexpr_inverse_sqrt(-0.0) == -std::numeric_limits<double>::infinity());
+
+  EXPECT_TRUE(std::isinf(inverse_square_roots[0]));
+  for (std::size_t index = 1; index < inverse_square_roots.size(); ++index) {
+    const double number = 0.25 * static_cast<double>(index);
+    EXPECT_DOUBLE_EQ(inverse_square_roots[index], 1.0 / std::sqrt(number));
+  }
+}
+
+TEST(ConstexprTable, ConstexprHypotGrid) {
+  for (std::size_t row = 0; row < distances.size(); ++row) {
+    for (std::size_t column = 0; column < distances[row].size(); ++column) {
+      EXPECT_DOUBLE_EQ(distances[row][column],
+                       std::hypot(static_cast<double>(column), static_cast<double>(row)));
+    }
+  }
+}
+
+TEST(ConstexprTable, LargeConstexprHypotGrid) {
+  // A realistically sized grid distance table must remain computable at compile time within the
+  // compiler's default constant expression evaluation limits.
+  constexpr std::array<std::array<double, 256>, 256> large_distances =
+      constexpr_hypot_grid<256, 256>(0.0, 255.0, 0.0, 255.0);
+  EXPECT_EQ(large_distances[0][0], 0.0);
+  EXPECT_EQ(large_distances[0][255], 255.0);
+  EXPECT_DOUBLE_EQ(large_distances[255][255], std::hypot(255.0, 255.0));
+  EXPECT_DOUBLE_EQ(large_distances[100][37], std::hypot(37.0, 100.0));
+}
+
+TEST(ConstexprTable, LargeConstexprInverseSqrtTable) {
+  // A realistically sized inverse square root table must remain computable at compile time within
+  // the compiler's default constant expression evaluation limits.
+  constexpr std::array<double, 65536> large_inverse_square_roots =
+      constexpr_inverse_sqrt_table<65536>(1.0, 65536.0);
+  EXPECT_EQ(large_inverse_square_roots[0], 1.0);
+  EXPECT_DOUBLE_EQ(large_inverse_square_roots[3], 0.5);
+  EXPECT_DOUBLE_EQ(large_inverse_square_roots[65535], 1.0 / 256.0);
+}
+
+}  // namespace
+
+}  // namespace utility